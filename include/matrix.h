@@ -11,6 +11,7 @@
 #include <vector>
 #include <cstdio>
 #include <sstream>
+#include <random>
 
 class Matrix{
 
@@ -34,6 +35,63 @@ class Matrix{
       return matrix;
     }
 
+    /**
+     * @brief Creating a matrix of the required size filled with uniformly distributed random values. Every row has its
+     * own generator seeded from the seed, the stream and the row index, so the same seed gives the same matrix for any
+     * number of threads.
+     * @param rows : Number of rows in the matrix.
+     * @param cols : Number of colummns in the matrix.
+     * @param seed : Seed for the random number generator.
+     * @param stream : Id of the matrix, matrices generated with the same seed and different streams are independent.
+     * @param min_value : Lower bound of the generated values.
+     * @param max_value : Upper bound of the generated values.
+     * @param num_threads : Number of threads used to fill the matrix.
+     * @return matrix : returns a 2D matrix.
+     */
+    double** RandomMatrix(int rows, int cols, unsigned int seed, unsigned int stream, double min_value,
+      double max_value, int num_threads){
+      if(rows <= 0 || cols <= 0){
+        return 0;
+      }
+      double** matrix = EmptyMatrix(rows, cols);
+      if(num_threads < 1){
+        num_threads = 1;
+      }
+      if(num_threads > rows){
+        num_threads = rows;
+      }
+      std::vector<std::thread> p;
+      int rows_per_thread = rows / num_threads;
+      int remainder = rows % num_threads;
+      int start = 0;
+      // Create a thread and divide the work, the first threads take one extra row each until the remainder is used.
+      for(int i = 0; i < num_threads; i++){
+        int rows_computed = rows_per_thread + (i < remainder ? 1 : 0);
+        p.emplace_back(RandomWorkerThread, matrix, start, rows_computed, cols, seed, stream, min_value, max_value);
+        start += rows_computed;
+      }
+      // Wait for all the threads to finish the work.
+      for(auto& t: p){
+        t.join();
+      }
+      return matrix;
+    }
+
+    /**
+     * @brief Releasing the memory of a matrix created by this library.
+     * @param matrix : The matrix to be deleted.
+     * @param rows : Number of rows in the matrix.
+     */
+    void DeleteMatrix(double** matrix, int rows){
+      if(matrix == 0){
+        return;
+      }
+      for(int i = 0; i < rows; i++){
+        delete[] matrix[i];
+      }
+      delete[] matrix;
+    }
+
     /**
      * @brief Create a 2D matrix based on user input.
      * @param str : string of matrix values.
@@ -100,15 +158,36 @@ class Matrix{
      * @param input_matrix
      * @param rows
      * @param cols
+     * @param verbose : Boolean to display which method is selected. Turn off when timing the call from outside.
      * @return transposed 2D matrix.
      */
-    double** transpose(double** input_matrix, int rows, int cols, int num_threads, bool show_timing){
+    double** transpose(double** input_matrix, int rows, int cols, int num_threads, bool show_timing,
+      bool verbose = true){
+      double** matrix = EmptyMatrix(cols, rows);
       if(num_threads <= 1){
-        return transmul(input_matrix, rows, cols, show_timing);
+        return transmul(input_matrix, matrix, rows, cols, show_timing);
       }else{
-        std::cout << "Multithreaded method is selected. " << std::endl << std::endl;
-        return TransmulThread(input_matrix, rows, cols, num_threads, show_timing);
+        if(verbose)
+          std::cout << "Multithreaded method is selected. " << std::endl << std::endl;
+        return TransmulThread(input_matrix, matrix, rows, cols, num_threads, show_timing);
+      }
+    }
+
+    /**
+     * @brief Transpose of the input matrix written into a matrix created by the caller, so the call does not allocate.
+     * Useful to time only the transpose itself.
+     * @param input_matrix : The input matrix.
+     * @param output_matrix : Matrix with cols rows and rows columns for the result.
+     * @param rows : Number of rows in the input matrix.
+     * @param cols : Number of columns in the input matrix.
+     * @param num_threads : Number of threads to perform the function.
+     * @return output_matrix holding the transposed matrix.
+     */
+    double** TransposeInto(double** input_matrix, double** output_matrix, int rows, int cols, int num_threads){
+      if(num_threads <= 1){
+        return transmul(input_matrix, output_matrix, rows, cols, false);
       }
+      return TransmulThread(input_matrix, output_matrix, rows, cols, num_threads, false);
     }
 
     /**
@@ -118,31 +197,78 @@ class Matrix{
      * @param r1 : Number of rows of the first matrix.
      * @param c1 : Number of colummns in the first matrix.
      * @param c2 : Number of colummns in the second matrix.
+     * @param verbose : Boolean to display which method is selected. Turn off when timing the call from outside.
      * @return result of multiplication.
      */
     double** multiplication(double** input_matrix_1, double** input_matrix_2, int r1, int c1, int c2, int num_threads,
-      bool show_timing){
+      bool show_timing, bool verbose = true){
+      double** matrix = EmptyMatrix(r1, c2);
       if(num_threads <= 1){
-        return matmul(input_matrix_1, input_matrix_2, r1, c1, c2, show_timing);
+        return matmul(input_matrix_1, input_matrix_2, matrix, r1, c1, c2, show_timing);
       }else{
-        std::cout << "Multithreaded method is selected. " << std::endl << std::endl;
-        return MatmulThread(input_matrix_1, input_matrix_2, r1, c1, c2, num_threads, show_timing);
+        if(verbose)
+          std::cout << "Multithreaded method is selected. " << std::endl << std::endl;
+        return MatmulThread(input_matrix_1, input_matrix_2, matrix, r1, c1, c2, num_threads, show_timing);
       }
     }
 
+    /**
+     * @brief Multiplication of two matrices written into a matrix created by the caller, so the call does not allocate.
+     * Useful to time only the multiplication itself. The results are added to the output matrix so it has to be zero
+     * filled, for example by creating it with EmptyMatrix.
+     * @param input_matrix_1 : First matrix.
+     * @param input_matrix_2 : Second matrix.
+     * @param output_matrix : Zero filled matrix with r1 rows and c2 columns for the result.
+     * @param r1 : Number of rows of the first matrix.
+     * @param c1 : Number of colummns in the first matrix.
+     * @param c2 : Number of colummns in the second matrix.
+     * @param num_threads : Number of threads to perform the operation.
+     * @return output_matrix holding the result of multiplication.
+     */
+    double** MultiplyInto(double** input_matrix_1, double** input_matrix_2, double** output_matrix, int r1, int c1,
+      int c2, int num_threads){
+      if(num_threads <= 1){
+        return matmul(input_matrix_1, input_matrix_2, output_matrix, r1, c1, c2, false);
+      }
+      return MatmulThread(input_matrix_1, input_matrix_2, output_matrix, r1, c1, c2, num_threads, false);
+    }
+
   private:
 
+    /**
+     * @brief Random matrix worker thread.
+     * @param matrix : Matrix to be filled.
+     * @param row_start : Row to start with.
+     * @param rows_computed : Number of rows to compute.
+     * @param cols : Number of columns.
+     * @param seed : Seed for the random number generator.
+     * @param stream : Id of the matrix.
+     * @param min_value : Lower bound of the generated values.
+     * @param max_value : Upper bound of the generated values.
+     */
+    static void RandomWorkerThread(double** matrix, int row_start, int rows_computed, int cols, unsigned int seed,
+      unsigned int stream, double min_value, double max_value){
+      std::uniform_real_distribution<double> distribution(min_value, max_value);
+      for(int i = row_start; i < rows_computed + row_start; i++){
+        std::seed_seq seq{seed, stream, static_cast<unsigned int>(i)};
+        std::mt19937_64 generator(seq);
+        for(int j = 0; j < cols; j++){
+          matrix[i][j] = distribution(generator);
+        }
+      }
+    }
+
     /**
      * @brief Function to perform the transpose on the matrix.
      * @param input_matrix
+     * @param matrix : Matrix for the result.
      * @param rows : Number of rows in the matrix.
      * @param cols : Number of colummns in the matrix.
      * @param show_timing : Boolean to display execution time.
      * @return transposed matrix.
      */
-    double** transmul(double** input_matrix, int rows, int cols, bool show_timing){
+    double** transmul(double** input_matrix, double** matrix, int rows, int cols, bool show_timing){
 
-      double** matrix = EmptyMatrix(cols, rows);
       std::chrono::system_clock::time_point begin;
       if (show_timing)
         begin = std::chrono::high_resolution_clock::now();
@@ -182,29 +308,33 @@ class Matrix{
      * @brief Multithreaded transpose function. The work will be divide among the threads. The difference can be noticed
      * with only very large matrix.
      * @param input_matrix : The input matrix.
+     * @param matrix : Matrix for the result.
      * @param rows : Number of rows in the matrix.
      * @param cols : Number of columns in the matrix.
      * @param num_threads : Number of threads to perform the function.
      * @param show_timing : Boolean to display execution time.
      * @return Transposed matrix.
      */
-    double** TransmulThread(double** input_matrix, int rows, int cols, int num_threads, bool show_timing){
+    double** TransmulThread(double** input_matrix, double** matrix, int rows, int cols, int num_threads,
+      bool show_timing){
 
-      double** matrix = EmptyMatrix(cols, rows);
       std::chrono::system_clock::time_point begin;
       if (show_timing)
         begin = std::chrono::high_resolution_clock::now();
 
       // array to hold all the threads.
       std::vector<std::thread> p;
+      if(num_threads > rows){
+        num_threads = rows;
+      }
       int rowThread = rows / num_threads;
-      // Create a thread and divide the work.
-      for(int i = 0; i < rows; i+=rowThread){
-        int rowCompute = rowThread;
-        if(rowThread + i > rows){
-          rowCompute = rows - i;
-        }
-        p.emplace_back(TransmulWorkerThread, matrix, input_matrix, i, rowCompute, cols);
+      int remainder = rows % num_threads;
+      int start = 0;
+      // Create a thread and divide the work, the first threads take one extra row each until the remainder is used.
+      for(int i = 0; i < num_threads; i++){
+        int rowCompute = rowThread + (i < remainder ? 1 : 0);
+        p.emplace_back(TransmulWorkerThread, matrix, input_matrix, start, rowCompute, cols);
+        start += rowCompute;
       }
       // Wait for all the threads to finish the work and then merge them together.
       for(auto& t: p){
@@ -224,15 +354,16 @@ class Matrix{
      * @brief Function to perform matrix multiplication on two 2D matrices.
      * @param input_matrix_1 : First matrix.
      * @param input_matrix_2 : Second matrix.
+     * @param matrix : Zero filled matrix for the result.
      * @param r1 : Number of rows of the first matrix.
      * @param c1 : Number of colummns in the first matrix.
      * @param c2 : Number of colummns in the second matrix.
      * @param show_timing : Boolean to display execution time.
      * @return Matrix after multiplication opeartion.
      */
-    double** matmul(double** input_matrix_1, double** input_matrix_2, int r1, int c1, int c2, bool show_timing){
+    double** matmul(double** input_matrix_1, double** input_matrix_2, double** matrix, int r1, int c1, int c2,
+      bool show_timing){
 
-      double** matrix = EmptyMatrix(r1, c2);
       std::chrono::system_clock::time_point begin;
       if (show_timing)
         begin = std::chrono::high_resolution_clock::now();
@@ -297,6 +428,7 @@ class Matrix{
      * generated.
      * @param input_matrix_1 : First matrix.
      * @param input_matrix_2 : Second matrix.
+     * @param matrix : Zero filled matrix for the result.
      * @param r1 : Number of rows in first matrix.
      * @param c1 : Number of columns in first matrix.
      * @param c2 : Number of columns in second matrix.
@@ -304,10 +436,9 @@ class Matrix{
      * @param show_timing : Boolean to display execution time.
      * @return : Result of matrix multiplication.
      */
-    double** MatmulThread(double** input_matrix_1, double** input_matrix_2, int r1, int c1, int c2, int num_threads,
-      bool show_timing){
+    double** MatmulThread(double** input_matrix_1, double** input_matrix_2, double** matrix, int r1, int c1, int c2,
+      int num_threads, bool show_timing){
 
-        double** matrix = EmptyMatrix(r1, c2);
         std::chrono::system_clock::time_point begin;
         if (show_timing)
           begin = std::chrono::high_resolution_clock::now();
@@ -28,15 +28,269 @@
  * Command for test mode:
  *  ./matmul test true
  * 
+ * bench / verify : These modes generate random matrices of the given size with a seeded multithreaded generator and run
+ * the function for 1, 2, 4, ... threads up to the given number of threads. Every result is compared against a slow
+ * reference implementation, multiplication results have to be within the rounding error bound of every element and
+ * transpose results have to match exactly. bench also reports the best time and throughput for every number of
+ * threads, verify only reports if the results passed.
+ *
+ * Command for bench and verify mode:
+ *  ./matmul bench multiply 8 42 1024 1024 1024 1024
+ *  ./matmul verify transpose 4 7 2000 3000
+ * 
  * @date 2021-06-25
  */
 
 #include "matrix.h"
 #include <sstream>
 #include <cstring>
+#include <limits>
+#include <cmath>
+#include <climits>
+
+/**
+ * @brief Slow reference transpose used to verify the results of the library.
+ * @param m : Matrix library used to allocate the result.
+ * @param input_matrix : The input matrix.
+ * @param rows : Number of rows in the matrix.
+ * @param cols : Number of columns in the matrix.
+ * @return Transposed matrix.
+ */
+static double** ReferenceTranspose(Matrix& m, double** input_matrix, int rows, int cols){
+  double** matrix = m.EmptyMatrix(cols, rows);
+  for(int i = 0; i < rows; i++){
+    for(int j = 0; j < cols; j++){
+      matrix[j][i] = input_matrix[i][j];
+    }
+  }
+  return matrix;
+}
+
+/**
+ * @brief Slow reference matrix multiplication used to verify the results of the library. The sums are accumulated in
+ * long double so the reference is at least as accurate as the library. The error bound of every element is the
+ * standard bound for a dot product of length c1, c1 * eps * sum_k |a_ik| * |b_kj|, which also holds when the sum is
+ * reordered or uses fused multiply add.
+ * @param m : Matrix library used to allocate the result.
+ * @param input_matrix_1 : First matrix.
+ * @param input_matrix_2 : Second matrix.
+ * @param r1 : Number of rows of the first matrix.
+ * @param c1 : Number of colummns in the first matrix.
+ * @param c2 : Number of colummns in the second matrix.
+ * @param error_bound : Matrix of size r1 x c2 which is filled with the allowed error of every element.
+ * @return Result of multiplication.
+ */
+static double** ReferenceMultiplication(Matrix& m, double** input_matrix_1, double** input_matrix_2, int r1, int c1,
+  int c2, double** error_bound){
+  double** matrix = m.EmptyMatrix(r1, c2);
+  const long double eps = std::numeric_limits<double>::epsilon();
+  for(int i = 0; i < r1; i++){
+    for(int j = 0; j < c2; j++){
+      long double sum = 0.0L;
+      long double abs_sum = 0.0L;
+      for(int k = 0; k < c1; k++){
+        long double product = static_cast<long double>(input_matrix_1[i][k]) * input_matrix_2[k][j];
+        sum += product;
+        abs_sum += std::fabs(product);
+      }
+      matrix[i][j] = static_cast<double>(sum);
+      error_bound[i][j] = static_cast<double>(c1 * eps * abs_sum);
+    }
+  }
+  return matrix;
+}
+
+/**
+ * @brief Function to compare if every element of a matrix is within its error bound of the expected matrix.
+ * @param m1 : Matrix to be checked.
+ * @param m2 : Expected matrix.
+ * @param error_bound : Allowed absolute error of every element.
+ * @param rows : Number of rows in the matrices.
+ * @param cols : Number of columns in the matrices.
+ * @return 1 if all the elements are within their bound otherwise 0.
+ */
+static int CheckErrorBound(double** m1, double** m2, double** error_bound, int rows, int cols){
+  for(int i = 0; i < rows; i++){
+    for(int j = 0; j < cols; j++){
+      // Written so that a NaN in the result fails the check.
+      if(!(std::fabs(m1[i][j] - m2[i][j]) <= error_bound[i][j]))
+        return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief Runs the bench or verify mode. Refer to the file description for the arguments.
+ * @param show_timing : true for bench mode which times every run, false for verify mode.
+ * @return 0 if all the results match the reference otherwise 1.
+ */
+static int RunBench(int argc, char** argv, bool show_timing){
+
+  // Number of runs for every thread count in bench mode, the fastest run is reported.
+  const int repetitions = 3;
+
+  if(argc < 7){
+    std::cerr << "Not enough arguments given to run the " << argv[1] << " mode. Refer to readme on how to use the "
+    << "arguments." << std::endl;
+    return 1;
+  }
+  bool multiply;
+  if(strcmp(argv[2], "transpose") == 0){
+    multiply = false;
+  }else if(strcmp(argv[2], "multiply") == 0){
+    multiply = true;
+  }else{
+    std::cerr << "You have selected " << argv[1] << " mode but did not specify the function transpose or multiply."
+    << std::endl;
+    return 1;
+  }
+  if(multiply && argc < 9){
+    std::cerr << "Not enough arguments given to run " << argv[1] << " mode for matrix multiplication. Refer to readme "
+    << "on how to use the arguments." << std::endl;
+    return 1;
+  }
+
+  int max_threads = atoi(argv[3]);
+  char* seed_end = 0;
+  unsigned long seed_value = strtoul(argv[4], &seed_end, 10);
+  int rows_1 = atoi(argv[5]);
+  int cols_1 = atoi(argv[6]);
+  int rows_2 = multiply ? atoi(argv[7]) : 0;
+  int cols_2 = multiply ? atoi(argv[8]) : 0;
+
+  // Check to see if the seed is a whole non negative number so the same seed always gives the same matrices.
+  if(argv[4][0] < '0' || argv[4][0] > '9' || *seed_end != '\0' || seed_value > UINT_MAX){
+    std::cerr << "Seed should be a non negative whole number not larger than " << UINT_MAX << std::endl;
+    return 1;
+  }
+  unsigned int seed = static_cast<unsigned int>(seed_value);
+
+  // Check to see if invalid matrix sizes are not entered.
+  if(rows_1 <= 0 || cols_1 <= 0 || (multiply && (rows_2 <= 0 || cols_2 <= 0))){
+    std::cerr << "Values are zero or less than zero" << std::endl;
+    return 1;
+  }
+
+  // Check to confirm cols of m1 are equal to rows of m2 otherwise matrix multiplication is not possible.
+  if(multiply && cols_1 != rows_2){
+    std::cerr << "Cannot multiply columns of first matrix should be equal to rows of second matrix " << std::endl;
+    return 1;
+  }
+
+  if(max_threads <= 0){
+    std::cerr << "Number of threads should be at least 1" << std::endl;
+    return 1;
+  }
+
+  // More threads than the hardware supports are still correct so they are allowed, but the timings will not show a
+  // speedup. A hardware concurrency of zero means it is unknown.
+  unsigned int hardware_threads = std::thread::hardware_concurrency();
+  if(show_timing && hardware_threads > 0 && max_threads > static_cast<int>(hardware_threads)){
+    std::cout << "You have selected number threads beyond your system capacity of " << hardware_threads << ". The "
+    << "results will be verified but the timings for more threads will not be meaningful." << std::endl << std::endl;
+  }
+
+  // The work is divided by rows so there cannot be more threads than rows.
+  if(max_threads > rows_1){
+    max_threads = rows_1;
+    std::cout << "You have entered number of threads more than the rows of the matrix so number of threads are set "
+    << "to " << max_threads << "." << std::endl << std::endl;
+  }
+
+  std::vector<int> thread_counts;
+  for(int t = 1; t < max_threads; t *= 2){
+    thread_counts.push_back(t);
+  }
+  thread_counts.push_back(max_threads);
+
+  Matrix m;
+  std::cout << std::endl;
+  std::cout << "Generating random matrices with seed " << seed << "." << std::endl << std::endl;
+
+  double** m1 = m.RandomMatrix(rows_1, cols_1, seed, 0, -1.0, 1.0, max_threads);
+  double** m2 = multiply ? m.RandomMatrix(rows_2, cols_2, seed, 1, -1.0, 1.0, max_threads) : 0;
+  int res_rows = multiply ? rows_1 : cols_1;
+  int res_cols = multiply ? cols_2 : rows_1;
+
+  // Transpose only moves values so it has to match the reference exactly.
+  std::cout << "Computing reference result." << std::endl << std::endl;
+  double** error_bound = multiply ? m.EmptyMatrix(res_rows, res_cols) : 0;
+  double** expec_mat = multiply ? ReferenceMultiplication(m, m1, m2, rows_1, cols_1, cols_2, error_bound) :
+    ReferenceTranspose(m, m1, rows_1, cols_1);
+
+  // Floating point operations for multiplication, bytes read and written for transpose.
+  double work = multiply ? 2.0 * rows_1 * cols_1 * cols_2 : 2.0 * rows_1 * cols_1 * sizeof(double);
+  long long single_thread_time = 0;
+  int failed = 0;
+
+  for(size_t n = 0; n < thread_counts.size(); n++){
+    int num_threads = thread_counts[n];
+    long long best_time = 0;
+    int passed = 1;
+    int runs = show_timing ? repetitions : 1;
+    for(int r = 0; r < runs; r++){
+      // The result is allocated before the timer starts so only the function itself is timed.
+      double** result = m.EmptyMatrix(res_rows, res_cols);
+      auto begin = std::chrono::high_resolution_clock::now();
+      if(multiply){
+        m.MultiplyInto(m1, m2, result, rows_1, cols_1, cols_2, num_threads);
+      }else{
+        m.TransposeInto(m1, result, rows_1, cols_1, num_threads);
+      }
+      auto end = std::chrono::high_resolution_clock::now();
+      long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+      if(r == 0 || elapsed < best_time){
+        best_time = elapsed;
+      }
+      int matched = multiply ? CheckErrorBound(result, expec_mat, error_bound, res_rows, res_cols) :
+        m.check(result, expec_mat, res_rows, res_cols);
+      if(!matched){
+        passed = 0;
+      }
+      m.DeleteMatrix(result, res_rows);
+    }
+    if(num_threads == 1){
+      single_thread_time = best_time;
+    }
+    if(!passed){
+      failed++;
+    }
+
+    std::cout << "Threads: " << num_threads;
+    if(show_timing){
+      double throughput = best_time > 0 ? work / best_time : 0.0;
+      std::cout << "  Best time: " << best_time << " nanoseconds  Throughput: " << throughput
+      << (multiply ? " GFLOP/s" : " GB/s");
+      if(single_thread_time > 0 && best_time > 0){
+        std::cout << "  Speedup: " << static_cast<double>(single_thread_time) / best_time << "x";
+      }
+    }
+    std::cout << "  Result: " << (passed ? "passed" : "failed") << std::endl << std::endl;
+  }
+
+  m.DeleteMatrix(m1, rows_1);
+  m.DeleteMatrix(m2, rows_2);
+  m.DeleteMatrix(expec_mat, res_rows);
+  m.DeleteMatrix(error_bound, res_rows);
+
+  if(failed == 0){
+    std::cout << "All " << thread_counts.size() << " thread counts matched the reference." << std::endl << std::endl;
+    return 0;
+  }
+  std::cout << "Only " << thread_counts.size() - failed << " out of " << thread_counts.size() << " thread counts "
+  << "matched the reference. Please look above to see which have failed." << std::endl << std::endl;
+  return 1;
+}
 
 int main(int argc, char** argv){
 
+  if(argc < 2){
+    std::cout << "You have not selected the mode manual, test, bench or verify. Refer to readme on how to use " <<
+    "arguments" << std::endl;
+    return 1;
+  }
+
   if(strcmp(argv[1], "manual") == 0){
 
     if(argc < 8){
@@ -336,8 +590,12 @@ int main(int argc, char** argv){
       std::cout << "Only " << 6 - count << " out of 6 test cases passed. Please look above to see which test " <<
       "cases have failed." << std::endl << std::endl;
     }
+  }
+  else if(strcmp(argv[1], "bench") == 0 || strcmp(argv[1], "verify") == 0){
+    return RunBench(argc, argv, strcmp(argv[1], "bench") == 0);
   }else{
-    std::cout << "You have not selected the mode manual or test. Refer to readme on how to use arguments" << std::endl;
+    std::cout << "You have not selected the mode manual, test, bench or verify. Refer to readme on how to use " <<
+    "arguments" << std::endl;
     return 1;
   }
 }
\ No newline at end of file